@@ -0,0 +1,119 @@
+#include "batching_predictor.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// In-process load generator comparing direct LinearRegression::predict calls
+// against BatchingPredictor. Each caller thread issues single-row requests in
+// a closed loop and records the latency of every request. Since every caller
+// has at most one request in flight, the size trigger can only fire when
+// there are at least max_batch_size threads.
+//
+// Usage: SiML_batching_benchmark [threads] [requests_per_thread] [features]
+//                                [max_batch_size] [max_latency_us]
+
+using namespace SiML;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    struct Report
+    {
+        double throughput; // requests per second
+        double p50_us;
+        double p99_us;
+        double checksum;   // sum of all predictions, printed so the calls are not optimized away
+    };
+
+    Report run_load(int n_threads, int n_requests, const Eigen::MatrixXd &X,
+                    const std::function<double(const Eigen::VectorXd &)> &call)
+    {
+        std::vector<std::vector<double>> latencies(n_threads);
+        std::vector<double> sinks(n_threads, 0.0);
+        std::vector<std::thread> threads;
+
+        const auto start = Clock::now();
+        for (int t = 0; t < n_threads; ++t) {
+            threads.emplace_back([&, t] {
+                latencies[t].reserve(n_requests);
+                for (int i = 0; i < n_requests; ++i) {
+                    const Eigen::VectorXd x = X.row((t * n_requests + i) % X.rows()).transpose();
+                    const auto begin = Clock::now();
+                    sinks[t] += call(x);
+                    latencies[t].push_back(std::chrono::duration<double, std::micro>(Clock::now() - begin).count());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::vector<double> all;
+        for (const auto &l : latencies) {
+            all.insert(all.end(), l.begin(), l.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        double checksum = 0.0;
+        for (double sink : sinks) {
+            checksum += sink;
+        }
+
+        return Report{static_cast<double>(all.size()) / elapsed,
+                      all[all.size() / 2],
+                      all[std::min(all.size() - 1, all.size() * 99 / 100)],
+                      checksum};
+    }
+
+    void print(const char *name, const Report &report)
+    {
+        std::cout << name
+                  << "  throughput: " << report.throughput << " req/s"
+                  << "  p50: " << report.p50_us << " us"
+                  << "  p99: " << report.p99_us << " us"
+                  << "  checksum: " << report.checksum << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int n_threads       = argc > 1 ? std::atoi(argv[1]) : 64;
+    const int n_requests      = argc > 2 ? std::atoi(argv[2]) : 5000;
+    const int n_features      = argc > 3 ? std::atoi(argv[3]) : 256;
+    const size_t batch_size   = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 32;
+    const long latency_us     = argc > 5 ? std::atol(argv[5]) : 100;
+
+    // Train briefly on random data; only the shape of the model matters here
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(1024, n_features);
+    Eigen::VectorXd y = Eigen::VectorXd::Random(1024);
+    auto model = std::make_shared<LinearRegression>();
+    model->train(X, y, std::make_shared<GradientDescent>(std::make_shared<MSE>(), 0.01, 10));
+
+    std::cout << n_threads << " threads x " << n_requests << " requests, "
+              << n_features << " features, batch " << batch_size
+              << ", deadline " << latency_us << " us" << std::endl;
+
+    const Report direct = run_load(n_threads, n_requests, X, [&](const Eigen::VectorXd &x) {
+        return model->predict(x.transpose())[0];
+    });
+    print("direct  ", direct);
+
+    BatchingPredictor predictor(model, batch_size, std::chrono::microseconds(latency_us));
+    const Report batched = run_load(n_threads, n_requests, X, [&](const Eigen::VectorXd &x) {
+        return predictor.predict(x).get();
+    });
+    print("batching", batched);
+
+    const double total = static_cast<double>(n_threads) * n_requests;
+    std::cout << "average batch size: " << total / static_cast<double>(predictor.batch_count()) << std::endl;
+    if (static_cast<size_t>(n_threads) < batch_size) {
+        std::cout << "note: fewer threads than max_batch_size, so every batch waits for the deadline" << std::endl;
+    }
+
+    return 0;
+}
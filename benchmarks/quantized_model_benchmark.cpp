@@ -0,0 +1,89 @@
+#include "quantized_model.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// Scores one batch of samples with many independent models, as a process
+// serving thousands of LinearRegression models would, and compares the
+// double-precision models against their int8 quantizations.
+//
+// Usage: SiML_quantized_benchmark [models] [samples] [features] [repetitions]
+
+using namespace SiML;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    // Run @p score for every model and return predictions per second
+    double measure(int n_models, int n_samples, int repetitions, double &checksum,
+                   const std::function<double(int)> &score)
+    {
+        const auto start = Clock::now();
+        for (int r = 0; r < repetitions; ++r) {
+            for (int m = 0; m < n_models; ++m) {
+                checksum += score(m);
+            }
+        }
+        const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        return static_cast<double>(n_models) * n_samples * repetitions / elapsed;
+    }
+
+    void print(const char *name, double throughput)
+    {
+        std::cout << name << "  throughput: " << throughput << " predictions/s" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int n_models    = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int n_samples   = argc > 2 ? std::atoi(argv[2]) : 64;
+    const int n_features  = argc > 3 ? std::atoi(argv[3]) : 1024;
+    const int repetitions = argc > 4 ? std::atoi(argv[4]) : 5;
+
+    // Models with random weights; the weights only need a realistic spread
+    Eigen::MatrixXd X_train = Eigen::MatrixXd::Random(256, n_features);
+    std::vector<LinearRegression> models(n_models);
+    std::vector<QuantizedLinearRegression> quantized;
+    std::vector<QuantizedLinearRegression> quantized_inputs;
+    auto optimizer = std::make_shared<GradientDescent>(std::make_shared<MSE>(), 0.01, 3);
+    for (int m = 0; m < n_models; ++m) {
+        models[m].train(X_train, Eigen::VectorXd::Random(256), optimizer);
+        quantized.emplace_back(models[m]);
+        quantized_inputs.emplace_back(models[m], true);
+    }
+
+    const size_t double_bytes = static_cast<size_t>(n_models) * n_features * sizeof(double);
+    const size_t int8_bytes   = static_cast<size_t>(n_models) * n_features * sizeof(std::int8_t);
+
+    std::cout << n_models << " models, " << n_samples << " samples, "
+              << n_features << " features" << std::endl;
+    std::cout << "resident weights  double: " << double_bytes / 1024 << " KiB"
+              << "  int8: " << int8_bytes / 1024 << " KiB"
+              << "  (" << static_cast<double>(double_bytes) / int8_bytes << "x smaller)" << std::endl;
+
+    const Eigen::MatrixXd X = Eigen::MatrixXd::Random(n_samples, n_features);
+    double checksum = 0.0;
+
+    print("double                   ", measure(n_models, n_samples, repetitions, checksum, [&](int m) {
+        return models[m].predict(X).sum();
+    }));
+    print("int8 weights             ", measure(n_models, n_samples, repetitions, checksum, [&](int m) {
+        return quantized[m].predict(X).sum();
+    }));
+    print("int8 weights + inputs    ", measure(n_models, n_samples, repetitions, checksum, [&](int m) {
+        return quantized_inputs[m].predict(X).sum();
+    }));
+
+    // Quantize the batch once and share it between all models
+    const QuantizedFeatures X_q = QuantizedLinearRegression::quantize_features(X);
+    print("int8, shared quantization", measure(n_models, n_samples, repetitions, checksum, [&](int m) {
+        return quantized[m].predict(X_q).sum();
+    }));
+
+    std::cout << "checksum: " << checksum << std::endl;
+
+    return 0;
+}
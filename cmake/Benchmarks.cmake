@@ -0,0 +1,22 @@
+# Benchmark executables (not registered with CTest)
+add_executable(SiML_batching_benchmark
+    ${CMAKE_SOURCE_DIR}/benchmarks/batching_predictor_benchmark.cpp
+)
+
+target_link_libraries(SiML_batching_benchmark PRIVATE ${SiML_LIB})
+
+target_include_directories(SiML_batching_benchmark PRIVATE
+    ${CMAKE_SOURCE_DIR}/include
+    ${eigen_SOURCE_DIR}
+)
+
+add_executable(SiML_quantized_benchmark
+    ${CMAKE_SOURCE_DIR}/benchmarks/quantized_model_benchmark.cpp
+)
+
+target_link_libraries(SiML_quantized_benchmark PRIVATE ${SiML_LIB})
+
+target_include_directories(SiML_quantized_benchmark PRIVATE
+    ${CMAKE_SOURCE_DIR}/include
+    ${eigen_SOURCE_DIR}
+)
@@ -17,6 +17,9 @@ add_executable(SiML_tests
     ${CMAKE_SOURCE_DIR}/tests/test_linear_regression_model.cpp
     ${CMAKE_SOURCE_DIR}/tests/test_MSE_loss_function.cpp
     ${CMAKE_SOURCE_DIR}/tests/test_Gradient_Descent_optimizer.cpp
+    ${CMAKE_SOURCE_DIR}/tests/test_quantized_linear_regression.cpp
+    ${CMAKE_SOURCE_DIR}/tests/test_batching_predictor.cpp
+    ${CMAKE_SOURCE_DIR}/tests/test_training_checkpoint.cpp
 )
 
 target_link_libraries(SiML_tests PRIVATE ${SiML_LIB} gtest_main)
@@ -0,0 +1,122 @@
+#ifndef BATCHING_PREDICTOR_HPP
+#define BATCHING_PREDICTOR_HPP
+#include "Eigen/Dense"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "model.hpp"
+
+namespace SiML
+{
+
+    /**
+     * @brief Thread-safe micro-batching wrapper around LinearRegression::predict.
+     *
+     * Many threads may submit single samples concurrently. Requests are pushed
+     * onto a lock-free multi-producer queue and a background worker groups them
+     * into one feature matrix, so that the model is evaluated with a single
+     * matrix-vector product per batch. A batch is flushed as soon as it holds
+     * @p max_batch_size samples or the oldest pending sample has waited
+     * @p max_latency, whichever comes first.
+     *
+     * The wrapped model must not be retrained while the predictor is alive.
+     */
+    class BatchingPredictor
+    {
+        public:
+            /**
+             * @brief Construct a new BatchingPredictor and start its worker thread.
+             *
+             * @param model Shared pointer to a trained linear regression model.
+             * @param max_batch_size Maximum number of samples evaluated together.
+             * @param max_latency Maximum time a sample waits before its batch is flushed.
+             *
+             * @throws std::invalid_argument if @p model is null or untrained, or
+             *         if @p max_batch_size is zero.
+             */
+            explicit BatchingPredictor(const std::shared_ptr<const LinearRegression> &model,
+                                       size_t max_batch_size,
+                                       std::chrono::microseconds max_latency);
+
+            /**
+             * @brief Flush all pending requests and stop the worker thread.
+             */
+            ~BatchingPredictor();
+
+            BatchingPredictor(const BatchingPredictor &) = delete;
+            BatchingPredictor &operator=(const BatchingPredictor &) = delete;
+
+            /**
+             * @brief Submit a single sample for prediction.
+             *
+             * @param features Feature vector of size (n_features).
+             * @return std::future<double> Completed with the prediction once the
+             *         batch containing the sample has been evaluated.
+             *
+             * @throws std::invalid_argument if the size of @p features does not
+             *         match the model's learned weights.
+             */
+            std::future<double> predict(const Eigen::VectorXd &features);
+
+            /**
+             * @brief Number of batches evaluated so far.
+             *
+             * Together with the number of submitted samples this gives the
+             * average batch size actually achieved.
+             */
+            size_t batch_count() const;
+
+        private:
+            /**
+             * @brief A pending prediction request, linked into the submission queue.
+             */
+            struct Request
+            {
+                Eigen::VectorXd features;                        /**< Sample to evaluate. */
+                std::promise<double> result;                     /**< Completed by the worker thread. */
+                std::chrono::steady_clock::time_point enqueued;  /**< Submission time, for the latency deadline. */
+                Request *next = nullptr;                         /**< Next (older) request in the queue. */
+            };
+
+            /**
+             * @brief Worker loop: wait for a full batch or the latency deadline, then flush.
+             */
+            void run();
+
+            /**
+             * @brief Move all queued requests to the end of @p batch, oldest first.
+             */
+            void drain(std::deque<std::unique_ptr<Request>> &batch);
+
+            /**
+             * @brief Evaluate up to max_batch_size requests from the front of @p batch.
+             */
+            void flush(std::deque<std::unique_ptr<Request>> &batch);
+
+            /**
+             * @brief Wake the worker thread.
+             */
+            void wake();
+
+            std::shared_ptr<const LinearRegression> m_model; /**< Model used for evaluation. */
+            size_t m_max_batch_size;                         /**< Flush threshold in samples. */
+            std::chrono::microseconds m_max_latency;         /**< Flush deadline for the oldest sample. */
+
+            std::atomic<Request *> m_head{nullptr};          /**< Lock-free LIFO of submitted requests. */
+            std::atomic<size_t> m_pending{0};                /**< Number of submitted requests not yet evaluated. */
+            std::atomic<size_t> m_batches{0};                /**< Number of batches evaluated. */
+            std::atomic<bool> m_stop{false};                 /**< Set when the predictor is destroyed. */
+
+            std::mutex m_wake_mutex;                         /**< Only used to park the idle worker. */
+            std::condition_variable m_wake;                  /**< Signalled on first request, full batch or stop. */
+            std::thread m_worker;                            /**< Background batching thread. */
+    };
+
+}
+
+#endif
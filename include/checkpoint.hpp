@@ -0,0 +1,86 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+#include "Eigen/Dense"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+namespace SiML
+{
+
+    /**
+     * @brief When and where an optimizer saves its training state.
+     *
+     * Checkpointing is disabled while @p path is empty. A checkpoint is
+     * written whenever either non-zero interval elapses, and always when the
+     * run finishes; with both intervals at zero, only the finished run is
+     * saved.
+     */
+    struct CheckpointConfig
+    {
+        std::filesystem::path path;                         /**< Checkpoint file; empty disables checkpointing. */
+        size_t every_epochs = 0;                            /**< Epochs between checkpoints (0 = off). */
+        std::chrono::duration<double> every_seconds{0.0};   /**< Wall time between checkpoints (0 = off). */
+        bool resume = false;                                /**< Continue from an existing file at @p path instead of overwriting it. */
+    };
+
+
+    /**
+     * @brief Snapshot of an optimizer run that can be resumed exactly.
+     *
+     * The binary layout is a fixed magic and version followed by the run
+     * fingerprint, the epoch counter, the learning rate, the bias and the
+     * weights, all stored in native byte order with full double precision.
+     * The fingerprint (data shape, data hash and epoch budget) identifies the
+     * run, so that a checkpoint is never resumed against different training
+     * data.
+     */
+    struct TrainingCheckpoint
+    {
+        std::uint64_t n_samples = 0;  /**< Rows of the training data. */
+        std::uint64_t max_epochs = 0; /**< Epoch budget of the run. */
+        std::uint64_t data_hash = 0;  /**< hash_data() of the training data. */
+        std::uint64_t epoch = 0;      /**< Number of completed epochs. */
+        double learning_rate = 0.0;   /**< Optimizer step size the run was started with. */
+        double bias = 0.0;            /**< Bias term after @p epoch epochs. */
+        Eigen::VectorXd weights;      /**< Weight vector after @p epoch epochs; its size is the number of features. */
+
+        /**
+         * @brief Cheap 64-bit hash of a training set, used to fingerprint a run.
+         *
+         * @param X Feature matrix of size (n_samples x n_features).
+         * @param y Target vector of size (n_samples).
+         * @return std::uint64_t Hash of the shapes and values of @p X and @p y.
+         */
+        static std::uint64_t hash_data(const Eigen::MatrixXd &X, const Eigen::VectorXd &y);
+
+        /**
+         * @brief Durably replace the checkpoint at @p path.
+         *
+         * The data is written to a temporary file next to @p path and flushed
+         * to stable storage before it is renamed over @p path; on POSIX systems
+         * the directory is synced as well. After a crash or power loss, @p path
+         * therefore holds either the previous or the new complete checkpoint.
+         * The temporary file is removed if writing fails.
+         *
+         * @param path Destination file.
+         *
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void save(const std::filesystem::path &path) const;
+
+        /**
+         * @brief Read a checkpoint written by save().
+         *
+         * @param path Checkpoint file.
+         * @return TrainingCheckpoint The stored training state.
+         *
+         * @throws std::runtime_error if the file cannot be read or is not a
+         *         valid checkpoint.
+         */
+        static TrainingCheckpoint load(const std::filesystem::path &path);
+    };
+
+}
+
+#endif
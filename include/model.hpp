@@ -83,9 +83,24 @@ namespace SiML
              */
             Eigen::VectorXd predict(const Eigen::MatrixXd &X) const override;
 
+            /**
+             * @brief Access the learned weight vector.
+             *
+             * @return const Eigen::VectorXd& Weights (size: n_features), empty
+             *         if the model has not been trained.
+             */
+            const Eigen::VectorXd &weights() const;
+
+            /**
+             * @brief Access the learned bias term.
+             *
+             * @return double Bias (intercept).
+             */
+            double bias() const;
+
         private:
             Eigen::VectorXd m_weights; /**< Weight vector for each feature. */
-            double m_bias;             /**< Bias term (intercept). */
+            double m_bias = 0.0;       /**< Bias term (intercept). */
     };
 }
 
@@ -3,6 +3,7 @@
 #include "Eigen/Dense"
 #include <memory>
 #include "loss_function.hpp"
+#include "checkpoint.hpp"
 
 namespace SiML
 {
@@ -61,6 +62,21 @@ namespace SiML
                                      double learning_rate,
                                      double epochs);
 
+            /**
+             * @brief Enable periodic checkpoints of the training state.
+             *
+             * While enabled, optimize() saves the epoch counter, weights and bias
+             * to @p config.path at the configured interval and when the run
+             * finishes, replacing any previous file. If @p config.resume is set
+             * and the file exists, optimize() instead continues from it,
+             * overwriting the initial weights and bias; the resumed run produces
+             * bit-identical parameters to an uninterrupted one.
+             *
+             * @param config Checkpoint location and interval; an empty path
+             *        disables checkpointing.
+             */
+            void set_checkpointing(const CheckpointConfig &config);
+
             /**
              * @brief Run the gradient descent optimization process.
              *
@@ -71,6 +87,10 @@ namespace SiML
              * @param y Target vector of size (n_samples).
              * @param weights Reference to the model's weight vector.
              * @param bias Reference to the model's bias term.
+             *
+             * @throws std::invalid_argument if a checkpoint being resumed was
+             *         written for different data, epochs or learning rate.
+             * @throws std::runtime_error if a checkpoint cannot be read or written.
              */
             void optimize(const Eigen::MatrixXd &X,
                           const Eigen::VectorXd &y,
@@ -81,6 +101,7 @@ namespace SiML
             std::shared_ptr<DifferentiableLossFunction> m_loss_fun; /**< Loss function used for gradient computation. */
             double m_learning_rate;                                 /**< Step size for parameter updates. */
             size_t m_max_epochs;                                    /**< Number of training iterations. */
+            CheckpointConfig m_checkpoint;                          /**< Checkpoint location and interval. */
     };
 
 }
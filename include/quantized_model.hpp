@@ -0,0 +1,151 @@
+#ifndef QUANTIZED_MODEL_HPP
+#define QUANTIZED_MODEL_HPP
+#include "Eigen/Dense"
+#include <cstdint>
+#include "model.hpp"
+
+namespace SiML
+{
+
+    /**
+     * @brief Accuracy of a quantized model relative to its double-precision source.
+     */
+    struct QuantizationError
+    {
+        double max_abs_error;  /**< Largest absolute prediction difference. */
+        double mean_abs_error; /**< Mean absolute prediction difference. */
+        double rmse;           /**< Root mean squared prediction difference. */
+    };
+
+
+    /**
+     * @brief Feature matrix quantized to int8 with one symmetric scale per row.
+     *
+     * Sample \f$ i \f$ is represented as \f$ x_i \approx s_{x,i} \, q_{x,i} \f$
+     * with \f$ q_{x,i} \in [-127, 127] \f$. The values are stored column-major,
+     * like Eigen::MatrixXd, so that scoring streams through them contiguously.
+     * Quantizing a batch once and scoring it with many models amortizes the
+     * conversion cost.
+     */
+    struct QuantizedFeatures
+    {
+        Eigen::Matrix<std::int8_t, Eigen::Dynamic, Eigen::Dynamic> values; /**< Quantized features (n_samples x n_features). */
+        Eigen::VectorXd scales;                                           /**< Per-sample scale \f$ s_{x,i} \f$. */
+    };
+
+
+    /**
+     * @brief Post-training int8 quantization of a LinearRegression model.
+     *
+     * The weights are quantized once, with a single affine mapping per model:
+     * \f[
+     *   w \approx s_w \, (q_w - z_w), \qquad q_w \in [-128, 127]
+     * \f]
+     * where \f$ s_w \f$ is the scale and \f$ z_w \f$ the zero-point. The
+     * resident weights are therefore one byte per feature instead of eight.
+     *
+     * When input quantization is enabled, every row of the feature matrix is
+     * additionally quantized symmetrically to int8 with its own scale
+     * \f$ s_x \f$, and the prediction is computed with an integer dot product:
+     * \f[
+     *   \hat{y} = s_x s_w \left( \sum_j q_{x,j} q_{w,j} - z_w \sum_j q_{x,j} \right) + b
+     * \f]
+     * Otherwise the double-precision features are multiplied with the
+     * quantized weights, each dequantized on the fly; that mode only reduces
+     * the resident size of the weights and performs double arithmetic.
+     */
+    class QuantizedLinearRegression
+    {
+        public:
+            /**
+             * @brief Quantize a trained linear regression model.
+             *
+             * @param model Trained double-precision model.
+             * @param quantize_inputs If true, features are quantized to int8
+             *        at prediction time and integer dot products are used.
+             *        This costs an extra pass over the features on every call;
+             *        for throughput, quantize a batch once with
+             *        quantize_features() and score it with every model.
+             *
+             * @throws std::invalid_argument if @p model has not been trained.
+             */
+            explicit QuantizedLinearRegression(const LinearRegression &model,
+                                               bool quantize_inputs = false);
+
+            /**
+             * @brief Predict target values for the given input features.
+             *
+             * @param X Feature matrix of size (n_samples x n_features).
+             * @return Eigen::VectorXd Vector of predictions.
+             *
+             * @throws std::invalid_argument if the number of features in @p X
+             *         does not match the quantized weights.
+             */
+            Eigen::VectorXd predict(const Eigen::MatrixXd &X) const;
+
+            /**
+             * @brief Predict target values for pre-quantized input features.
+             *
+             * Always uses the integer dot-product kernel, regardless of
+             * quantizes_inputs().
+             *
+             * @param X Features produced by quantize_features().
+             * @return Eigen::VectorXd Vector of predictions.
+             *
+             * @throws std::invalid_argument if the number of features in @p X
+             *         does not match the quantized weights.
+             */
+            Eigen::VectorXd predict(const QuantizedFeatures &X) const;
+
+            /**
+             * @brief Quantize a feature matrix for use with predict(const QuantizedFeatures &).
+             *
+             * @param X Feature matrix of size (n_samples x n_features).
+             * @return QuantizedFeatures The int8 features and per-sample scales.
+             */
+            static QuantizedFeatures quantize_features(const Eigen::MatrixXd &X);
+
+            /**
+             * @brief Measure the prediction error against the double-precision model.
+             *
+             * @param reference The model this instance was quantized from.
+             * @param X Feature matrix used for the comparison.
+             * @return QuantizationError Error statistics over the rows of @p X.
+             *
+             * @throws std::invalid_argument if @p X is empty or its number of
+             *         features does not match either model.
+             */
+            QuantizationError quantization_error(const LinearRegression &reference,
+                                                 const Eigen::MatrixXd &X) const;
+
+            /**
+             * @brief Quantized weights (size: n_features).
+             */
+            const Eigen::Matrix<std::int8_t, Eigen::Dynamic, 1> &weights() const;
+
+            /**
+             * @brief Weight scale \f$ s_w \f$.
+             */
+            double scale() const;
+
+            /**
+             * @brief Weight zero-point \f$ z_w \f$.
+             */
+            std::int32_t zero_point() const;
+
+            /**
+             * @brief Whether features are quantized at prediction time.
+             */
+            bool quantizes_inputs() const;
+
+        private:
+            Eigen::Matrix<std::int8_t, Eigen::Dynamic, 1> m_weights; /**< Quantized weights. */
+            double m_scale;                                          /**< Weight scale. */
+            std::int32_t m_zero_point;                               /**< Weight zero-point. */
+            double m_bias;                                           /**< Bias term, kept in double precision. */
+            bool m_quantize_inputs;                                  /**< Quantize features before the dot product. */
+    };
+
+}
+
+#endif
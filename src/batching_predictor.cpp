@@ -0,0 +1,166 @@
+#include "batching_predictor.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <vector>
+
+namespace SiML
+{
+    BatchingPredictor::BatchingPredictor(const std::shared_ptr<const LinearRegression> &model,
+        size_t max_batch_size, std::chrono::microseconds max_latency):
+    m_model(model),
+    m_max_batch_size(max_batch_size),
+    m_max_latency(max_latency)
+    {
+        if (!m_model) {
+            throw std::invalid_argument("Model cannot be null");
+        }
+
+        if (m_model->weights().size() == 0) {
+            throw std::invalid_argument("Model must be trained before batching predictions");
+        }
+
+        if (m_max_batch_size == 0) {
+            throw std::invalid_argument("Maximum batch size must be positive");
+        }
+
+        m_worker = std::thread(&BatchingPredictor::run, this);
+    }
+
+    BatchingPredictor::~BatchingPredictor()
+    {
+        m_stop.store(true);
+        wake();
+        m_worker.join();
+    }
+
+    std::future<double> BatchingPredictor::predict(const Eigen::VectorXd &features)
+    {
+        if (features.size() != m_model->weights().size()) {
+            throw std::invalid_argument("Number of features does not match model weights");
+        }
+
+        auto *request = new Request{features, {}, std::chrono::steady_clock::now(), nullptr};
+        std::future<double> result = request->result.get_future();
+
+        // Count the request before publishing it, so m_pending never drops
+        // below the number of requests the worker holds
+        const size_t pending = m_pending.fetch_add(1) + 1;
+
+        request->next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(request->next, request,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed))
+        {}
+
+        // Wake the worker to start the latency clock, or to flush a full batch
+        if (pending == 1 || pending == m_max_batch_size) {
+            wake();
+        }
+
+        return result;
+    }
+
+    void BatchingPredictor::wake()
+    {
+        // Taking the mutex orders the notification after the worker's predicate
+        // check, so a wakeup cannot be lost between the check and the wait
+        {
+            std::lock_guard<std::mutex> lock(m_wake_mutex);
+        }
+        m_wake.notify_one();
+    }
+
+    void BatchingPredictor::run()
+    {
+        // Requests detached from the queue, oldest first; owned by this thread
+        std::deque<std::unique_ptr<Request>> batch;
+
+        for (;;)
+        {
+            drain(batch);
+            const bool stopping = m_stop.load();
+
+            // Evaluate every full batch, or everything once stopping
+            while (batch.size() >= m_max_batch_size || (stopping && !batch.empty())) {
+                flush(batch);
+            }
+
+            if (batch.empty())
+            {
+                if (stopping && m_pending.load() == 0) {
+                    break; // stopped with nothing left to do
+                }
+
+                std::unique_lock<std::mutex> lock(m_wake_mutex);
+                m_wake.wait(lock, [this] { return m_pending.load() > 0 || m_stop.load(); });
+                continue;
+            }
+
+            // The oldest sample decides when the partial batch is due
+            const auto deadline = batch.front()->enqueued + m_max_latency;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                flush(batch);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_wake_mutex);
+            m_wake.wait_until(lock, deadline, [this] {
+                return m_pending.load() >= m_max_batch_size || m_stop.load();
+            });
+        }
+    }
+
+    void BatchingPredictor::drain(std::deque<std::unique_ptr<Request>> &batch)
+    {
+        // Detach the whole LIFO and append it in submission order
+        Request *node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        const size_t old_size = batch.size();
+        for (; node != nullptr; node = node->next) {
+            batch.emplace_back(node);
+        }
+        std::reverse(batch.begin() + static_cast<std::ptrdiff_t>(old_size), batch.end());
+    }
+
+    void BatchingPredictor::flush(std::deque<std::unique_ptr<Request>> &batch)
+    {
+        const size_t count = std::min(batch.size(), m_max_batch_size);
+        const Eigen::Index n_features = m_model->weights().size();
+
+        Eigen::MatrixXd X(static_cast<Eigen::Index>(count), n_features);
+        for (size_t i = 0; i < count; ++i) {
+            X.row(static_cast<Eigen::Index>(i)) = batch[i]->features.transpose();
+        }
+
+        Eigen::VectorXd predictions;
+        std::exception_ptr error;
+        try {
+            predictions = m_model->predict(X);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        // Update the counters before any caller can observe its result
+        m_pending.fetch_sub(count);
+        m_batches.fetch_add(1);
+
+        for (size_t i = 0; i < count; ++i) {
+            if (error) {
+                batch[i]->result.set_exception(error);
+            }
+            else {
+                batch[i]->result.set_value(predictions[static_cast<Eigen::Index>(i)]);
+            }
+        }
+
+        batch.erase(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+
+    size_t BatchingPredictor::batch_count() const
+    {
+        return m_batches.load();
+    }
+}
@@ -0,0 +1,172 @@
+#include "checkpoint.hpp"
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace SiML
+{
+    namespace
+    {
+        constexpr std::array<char, 8> k_magic = {'S', 'i', 'M', 'L', 'C', 'K', 'P', 'T'};
+        constexpr std::uint32_t k_version = 2;
+
+        template <typename T>
+        bool write_value(std::FILE *file, const T &value)
+        {
+            return std::fwrite(&value, sizeof(T), 1, file) == 1;
+        }
+
+        template <typename T>
+        void read_value(std::ifstream &in, T &value)
+        {
+            in.read(reinterpret_cast<char *>(&value), sizeof(T));
+        }
+
+        // Flush the file's data from the OS cache to stable storage
+        bool sync_file(std::FILE *file)
+        {
+#ifdef _WIN32
+            return _commit(_fileno(file)) == 0;
+#else
+            return ::fsync(::fileno(file)) == 0;
+#endif
+        }
+
+        // Persist the directory entry created by a rename. Best effort: not
+        // every platform or file system can sync a directory.
+        void sync_directory(const std::filesystem::path &directory)
+        {
+#ifndef _WIN32
+            const std::string name = directory.empty() ? std::string(".") : directory.string();
+            const int fd = ::open(name.c_str(), O_RDONLY | O_DIRECTORY);
+            if (fd >= 0) {
+                ::fsync(fd);
+                ::close(fd);
+            }
+#else
+            (void)directory;
+#endif
+        }
+
+        void mix(std::uint64_t &hash, std::uint64_t value)
+        {
+            hash = (hash ^ value) * 0x9E3779B97F4A7C15ULL;
+            hash ^= hash >> 29;
+        }
+
+        void mix_values(std::uint64_t &hash, const double *values, Eigen::Index size)
+        {
+            for (Eigen::Index i = 0; i < size; ++i) {
+                std::uint64_t bits;
+                std::memcpy(&bits, values + i, sizeof(bits));
+                mix(hash, bits);
+            }
+        }
+    }
+
+    std::uint64_t TrainingCheckpoint::hash_data(const Eigen::MatrixXd &X, const Eigen::VectorXd &y)
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ULL;
+        mix(hash, static_cast<std::uint64_t>(X.rows()));
+        mix(hash, static_cast<std::uint64_t>(X.cols()));
+        mix(hash, static_cast<std::uint64_t>(y.size()));
+        mix_values(hash, X.data(), X.size());
+        mix_values(hash, y.data(), y.size());
+        return hash;
+    }
+
+    void TrainingCheckpoint::save(const std::filesystem::path &path) const
+    {
+        std::filesystem::path tmp_path = path;
+        tmp_path += ".tmp";
+
+        std::FILE *file = std::fopen(tmp_path.string().c_str(), "wb");
+        if (!file) {
+            throw std::runtime_error("Cannot open checkpoint file for writing: " + tmp_path.string());
+        }
+
+        const std::uint64_t n_weights = static_cast<std::uint64_t>(weights.size());
+        bool ok = std::fwrite(k_magic.data(), 1, k_magic.size(), file) == k_magic.size() &&
+                  write_value(file, k_version) &&
+                  write_value(file, n_samples) &&
+                  write_value(file, max_epochs) &&
+                  write_value(file, data_hash) &&
+                  write_value(file, epoch) &&
+                  write_value(file, learning_rate) &&
+                  write_value(file, bias) &&
+                  write_value(file, n_weights) &&
+                  std::fwrite(weights.data(), sizeof(double), weights.size(), file) == n_weights;
+
+        // The data must be on disk before the rename can make it visible
+        ok = ok && std::fflush(file) == 0 && sync_file(file);
+        ok = (std::fclose(file) == 0) && ok;
+
+        std::error_code error;
+        if (ok) {
+            std::filesystem::rename(tmp_path, path, error);
+        }
+        if (!ok || error) {
+            std::filesystem::remove(tmp_path, error);
+            throw std::runtime_error("Failed to write checkpoint file: " + path.string());
+        }
+
+        sync_directory(path.parent_path());
+    }
+
+    TrainingCheckpoint TrainingCheckpoint::load(const std::filesystem::path &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open checkpoint file: " + path.string());
+        }
+
+        std::array<char, 8> magic{};
+        std::uint32_t version = 0;
+        in.read(magic.data(), magic.size());
+        read_value(in, version);
+        if (!in || magic != k_magic || version != k_version) {
+            throw std::runtime_error("Not a valid checkpoint file: " + path.string());
+        }
+
+        TrainingCheckpoint checkpoint;
+        std::uint64_t n_weights = 0;
+        read_value(in, checkpoint.n_samples);
+        read_value(in, checkpoint.max_epochs);
+        read_value(in, checkpoint.data_hash);
+        read_value(in, checkpoint.epoch);
+        read_value(in, checkpoint.learning_rate);
+        read_value(in, checkpoint.bias);
+        read_value(in, n_weights);
+        if (!in) {
+            throw std::runtime_error("Truncated checkpoint file: " + path.string());
+        }
+
+        // Check the remaining size before allocating, to reject corrupt headers
+        const std::streampos data_begin = in.tellg();
+        in.seekg(0, std::ios::end);
+        const std::streamoff remaining = in.tellg() - data_begin;
+        in.seekg(data_begin);
+        if (remaining < 0 || static_cast<std::uint64_t>(remaining) % sizeof(double) != 0 ||
+            static_cast<std::uint64_t>(remaining) / sizeof(double) != n_weights) {
+            throw std::runtime_error("Truncated checkpoint file: " + path.string());
+        }
+
+        checkpoint.weights.resize(static_cast<Eigen::Index>(n_weights));
+        in.read(reinterpret_cast<char *>(checkpoint.weights.data()),
+                static_cast<std::streamsize>(n_weights * sizeof(double)));
+        if (!in) {
+            throw std::runtime_error("Truncated checkpoint file: " + path.string());
+        }
+
+        return checkpoint;
+    }
+}
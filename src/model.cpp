@@ -32,4 +32,14 @@ namespace SiML
 
         return (X * m_weights).array() + m_bias;
     }
+
+    const Eigen::VectorXd &LinearRegression::weights() const
+    {
+        return m_weights;
+    }
+
+    double LinearRegression::bias() const
+    {
+        return m_bias;
+    }
 }
\ No newline at end of file
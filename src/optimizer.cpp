@@ -1,5 +1,9 @@
 #include "optimizer.hpp"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
 #include <iostream>
+#include <stdexcept>
 
 namespace SiML
 {
@@ -10,13 +14,58 @@ namespace SiML
     m_max_epochs(epochs)
     {}
 
+    void GradientDescent::set_checkpointing(const CheckpointConfig &config)
+    {
+        m_checkpoint = config;
+    }
+
     void GradientDescent::optimize(const Eigen::MatrixXd &X,
                                const Eigen::VectorXd &y,
                                Eigen::VectorXd &weights, double &bias) const
     {
         const int m = X.rows(); // number of samples
+        const bool checkpointing = !m_checkpoint.path.empty();
+
+        // Identifies this run, so that a checkpoint is only resumed by the same run
+        const std::uint64_t data_hash = checkpointing ? TrainingCheckpoint::hash_data(X, y) : 0;
+
+        size_t start_epoch = 0;
+        if (checkpointing && m_checkpoint.resume && std::filesystem::exists(m_checkpoint.path)) {
+            TrainingCheckpoint checkpoint = TrainingCheckpoint::load(m_checkpoint.path);
+
+            if (checkpoint.weights.size() != X.cols() ||
+                checkpoint.n_samples != static_cast<std::uint64_t>(X.rows()) ||
+                checkpoint.data_hash != data_hash) {
+                throw std::invalid_argument("Checkpoint was written for different training data");
+            }
+            if (checkpoint.max_epochs != m_max_epochs) {
+                throw std::invalid_argument("Checkpoint was written with a different number of epochs");
+            }
+            if (checkpoint.learning_rate != m_learning_rate) {
+                throw std::invalid_argument("Checkpoint was written with a different learning rate");
+            }
+
+            weights     = std::move(checkpoint.weights);
+            bias        = checkpoint.bias;
+            start_epoch = static_cast<size_t>(checkpoint.epoch);
+        }
+
+        auto save_checkpoint = [&](size_t completed_epochs) {
+            TrainingCheckpoint checkpoint;
+            checkpoint.n_samples     = static_cast<std::uint64_t>(X.rows());
+            checkpoint.max_epochs    = m_max_epochs;
+            checkpoint.data_hash     = data_hash;
+            checkpoint.epoch         = completed_epochs;
+            checkpoint.learning_rate = m_learning_rate;
+            checkpoint.bias          = bias;
+            checkpoint.weights       = weights;
+            checkpoint.save(m_checkpoint.path);
+        };
 
-        for (size_t epoch = 0; epoch < m_max_epochs; ++epoch)
+        size_t last_saved_epoch = start_epoch;
+        auto last_saved_time    = std::chrono::steady_clock::now();
+
+        for (size_t epoch = start_epoch; epoch < m_max_epochs; ++epoch)
         {
             // Predictions: y_pred = X * w + b
             const Eigen::VectorXd predictions = X * weights + Eigen::VectorXd::Ones(m) * bias;
@@ -28,6 +77,27 @@ namespace SiML
             // Update parameters
             weights -= m_learning_rate * dw;
             bias    -= m_learning_rate * db;
+
+            if (checkpointing)
+            {
+                const size_t completed = epoch + 1;
+                const auto now = std::chrono::steady_clock::now();
+                const bool epoch_due = m_checkpoint.every_epochs > 0 &&
+                                       completed - last_saved_epoch >= m_checkpoint.every_epochs;
+                const bool time_due  = m_checkpoint.every_seconds.count() > 0.0 &&
+                                       now - last_saved_time >= m_checkpoint.every_seconds;
+
+                if (epoch_due || time_due) {
+                    save_checkpoint(completed);
+                    last_saved_epoch = completed;
+                    last_saved_time  = now;
+                }
+            }
+        }
+
+        // Record the finished run so that a restart does not repeat it
+        if (checkpointing && last_saved_epoch < m_max_epochs) {
+            save_checkpoint(m_max_epochs);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include "quantized_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace SiML
+{
+    namespace
+    {
+        constexpr std::int32_t k_qmin = -128;
+        constexpr std::int32_t k_qmax = 127;
+
+        // Rows scored together, so that the per-row accumulators stay in L1
+        constexpr Eigen::Index k_row_tile = 512;
+
+        // |q_x * (q_w - z_w)| <= 127 * 255, so this many columns always fit
+        // in an int32 accumulator before they are flushed to double.
+        constexpr Eigen::Index k_col_block = 1 << 15;
+
+        std::int8_t saturate(double value)
+        {
+            const double clamped = std::clamp(std::nearbyint(value),
+                                              static_cast<double>(k_qmin),
+                                              static_cast<double>(k_qmax));
+            return static_cast<std::int8_t>(clamped);
+        }
+
+        // Round half away from zero; unlike std::nearbyint this compiles to an
+        // add and a truncating conversion, which vectorize.
+        std::int8_t round_to_int8(double value)
+        {
+            return static_cast<std::int8_t>(static_cast<std::int32_t>(value + std::copysign(0.5, value)));
+        }
+    }
+
+    QuantizedLinearRegression::QuantizedLinearRegression(const LinearRegression &model,
+                                                         bool quantize_inputs):
+    m_scale(1.0),
+    m_zero_point(0),
+    m_bias(model.bias()),
+    m_quantize_inputs(quantize_inputs)
+    {
+        const Eigen::VectorXd &weights = model.weights();
+        if (weights.size() == 0) {
+            throw std::invalid_argument("Cannot quantize an untrained model");
+        }
+
+        // The representable range must contain zero so that it maps exactly
+        const double lo = std::min(weights.minCoeff(), 0.0);
+        const double hi = std::max(weights.maxCoeff(), 0.0);
+
+        if (hi > lo) {
+            m_scale = (hi - lo) / static_cast<double>(k_qmax - k_qmin);
+            m_zero_point = std::clamp(static_cast<std::int32_t>(std::nearbyint(k_qmin - lo / m_scale)),
+                                      k_qmin, k_qmax);
+        }
+
+        m_weights.resize(weights.size());
+        for (Eigen::Index j = 0; j < weights.size(); ++j) {
+            m_weights[j] = saturate(weights[j] / m_scale + m_zero_point);
+        }
+    }
+
+    Eigen::VectorXd QuantizedLinearRegression::predict(const Eigen::MatrixXd &X) const
+    {
+        if (X.cols() != m_weights.size()) {
+            throw std::invalid_argument("Number of features in X does not match model weights");
+        }
+
+        if (m_quantize_inputs) {
+            return predict(quantize_features(X));
+        }
+
+        // Accumulate sum_j x_ij * (q_j - z) column by column, dequantizing each
+        // weight on the fly instead of materializing a double weight vector
+        auto dequantized_step = [this](Eigen::Index j) {
+            return static_cast<double>(static_cast<std::int32_t>(m_weights[j]) - m_zero_point);
+        };
+        const Eigen::Index n_samples = X.rows();
+        Eigen::VectorXd acc = Eigen::VectorXd::Zero(n_samples);
+
+        for (Eigen::Index row = 0; row < n_samples; row += k_row_tile)
+        {
+            const Eigen::Index rows = std::min(k_row_tile, n_samples - row);
+            double *out = acc.data() + row;
+            Eigen::Index j = 0;
+            for (; j + 4 <= X.cols(); j += 4)
+            {
+                const double w0 = dequantized_step(j), w1 = dequantized_step(j + 1);
+                const double w2 = dequantized_step(j + 2), w3 = dequantized_step(j + 3);
+                const double *x0 = X.data() + j * n_samples + row;
+                const double *x1 = x0 + n_samples, *x2 = x1 + n_samples, *x3 = x2 + n_samples;
+                for (Eigen::Index i = 0; i < rows; ++i) {
+                    out[i] += x0[i] * w0 + x1[i] * w1 + x2[i] * w2 + x3[i] * w3;
+                }
+            }
+            for (; j < X.cols(); ++j)
+            {
+                const double w = dequantized_step(j);
+                const double *x = X.data() + j * n_samples + row;
+                for (Eigen::Index i = 0; i < rows; ++i) {
+                    out[i] += x[i] * w;
+                }
+            }
+        }
+
+        return (m_scale * acc).array() + m_bias;
+    }
+
+    Eigen::VectorXd QuantizedLinearRegression::predict(const QuantizedFeatures &X) const
+    {
+        if (X.values.cols() != m_weights.size()) {
+            throw std::invalid_argument("Number of features in X does not match model weights");
+        }
+
+        const Eigen::Index n_samples = X.values.rows();
+        const Eigen::Index n_features = X.values.cols();
+
+        // q_w - z_w lies in [-255, 255] and |q_x| <= 127, so every product fits
+        // in int16; 16-bit multiplies vectorize on any SIMD baseline
+        auto integer_step = [this](Eigen::Index j) {
+            return static_cast<std::int16_t>(static_cast<std::int32_t>(m_weights[j]) - m_zero_point);
+        };
+
+        // A single sample is contiguous, so score it as one integer dot product
+        if (n_samples == 1) {
+            std::int64_t dot = 0;
+            for (Eigen::Index col = 0; col < n_features; col += k_col_block)
+            {
+                const Eigen::Index col_end = std::min(n_features, col + k_col_block);
+                std::int32_t block_dot = 0;
+                for (Eigen::Index j = col; j < col_end; ++j) {
+                    block_dot += static_cast<std::int16_t>(X.values.data()[j] * integer_step(j));
+                }
+                dot += block_dot;
+            }
+            return Eigen::VectorXd::Constant(1, m_scale * X.scales[0] * static_cast<double>(dot) + m_bias);
+        }
+
+        Eigen::VectorXd acc = Eigen::VectorXd::Zero(n_samples);
+        std::vector<std::int32_t> block_acc(static_cast<size_t>(std::min(k_row_tile, n_samples)));
+
+        // Integer kernel: for a tile of rows, stream the int8 feature columns and
+        // accumulate q_x * (q_w - z_w) in int32, four columns at a time
+        for (Eigen::Index row = 0; row < n_samples; row += k_row_tile)
+        {
+            const Eigen::Index rows = std::min(k_row_tile, n_samples - row);
+            for (Eigen::Index col = 0; col < n_features; col += k_col_block)
+            {
+                const Eigen::Index col_end = std::min(n_features, col + k_col_block);
+                std::fill(block_acc.begin(), block_acc.begin() + rows, 0);
+                std::int32_t *out = block_acc.data();
+
+                Eigen::Index j = col;
+                for (; j + 4 <= col_end; j += 4)
+                {
+                    const std::int16_t w0 = integer_step(j), w1 = integer_step(j + 1);
+                    const std::int16_t w2 = integer_step(j + 2), w3 = integer_step(j + 3);
+                    const std::int8_t *x0 = X.values.data() + j * n_samples + row;
+                    const std::int8_t *x1 = x0 + n_samples, *x2 = x1 + n_samples, *x3 = x2 + n_samples;
+                    for (Eigen::Index i = 0; i < rows; ++i) {
+                        out[i] += static_cast<std::int16_t>(x0[i] * w0) + static_cast<std::int16_t>(x1[i] * w1) +
+                                  static_cast<std::int16_t>(x2[i] * w2) + static_cast<std::int16_t>(x3[i] * w3);
+                    }
+                }
+                for (; j < col_end; ++j)
+                {
+                    const std::int16_t w = integer_step(j);
+                    const std::int8_t *x = X.values.data() + j * n_samples + row;
+                    for (Eigen::Index i = 0; i < rows; ++i) {
+                        out[i] += static_cast<std::int16_t>(x[i] * w);
+                    }
+                }
+
+                for (Eigen::Index i = 0; i < rows; ++i) {
+                    acc[row + i] += static_cast<double>(out[i]);
+                }
+            }
+        }
+
+        return (m_scale * X.scales.cwiseProduct(acc)).array() + m_bias;
+    }
+
+    QuantizedFeatures QuantizedLinearRegression::quantize_features(const Eigen::MatrixXd &X)
+    {
+        const Eigen::Index n_samples = X.rows();
+
+        // Per-row range, computed column-wise so the reduction reads X contiguously
+        Eigen::VectorXd max_abs = Eigen::VectorXd::Zero(n_samples);
+        for (Eigen::Index j = 0; j < X.cols(); ++j) {
+            max_abs = max_abs.cwiseMax(X.col(j).cwiseAbs());
+        }
+
+        QuantizedFeatures features;
+        features.scales.resize(n_samples);
+        Eigen::VectorXd inv_scales(n_samples);
+        for (Eigen::Index i = 0; i < n_samples; ++i) {
+            const bool nonzero = max_abs[i] > 0.0;
+            features.scales[i] = nonzero ? max_abs[i] / static_cast<double>(k_qmax) : 1.0;
+            inv_scales[i]      = nonzero ? static_cast<double>(k_qmax) / max_abs[i] : 1.0;
+        }
+
+        features.values.resize(n_samples, X.cols());
+        for (Eigen::Index j = 0; j < X.cols(); ++j)
+        {
+            const double *x = X.data() + j * n_samples;
+            const double *inv = inv_scales.data();
+            std::int8_t *q = features.values.data() + j * n_samples;
+            for (Eigen::Index i = 0; i < n_samples; ++i) {
+                q[i] = round_to_int8(x[i] * inv[i]);
+            }
+        }
+
+        return features;
+    }
+
+    QuantizationError QuantizedLinearRegression::quantization_error(const LinearRegression &reference,
+                                                                    const Eigen::MatrixXd &X) const
+    {
+        if (X.rows() == 0) {
+            throw std::invalid_argument("X must contain at least one sample");
+        }
+
+        const Eigen::ArrayXd diff = (predict(X) - reference.predict(X)).array().abs();
+
+        return QuantizationError{diff.maxCoeff(),
+                                 diff.mean(),
+                                 std::sqrt(diff.square().mean())};
+    }
+
+    const Eigen::Matrix<std::int8_t, Eigen::Dynamic, 1> &QuantizedLinearRegression::weights() const
+    {
+        return m_weights;
+    }
+
+    double QuantizedLinearRegression::scale() const
+    {
+        return m_scale;
+    }
+
+    std::int32_t QuantizedLinearRegression::zero_point() const
+    {
+        return m_zero_point;
+    }
+
+    bool QuantizedLinearRegression::quantizes_inputs() const
+    {
+        return m_quantize_inputs;
+    }
+}
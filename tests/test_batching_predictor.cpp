@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "batching_predictor.hpp"
+#include <thread>
+#include <vector>
+
+using namespace SiML;
+
+namespace {
+    std::shared_ptr<LinearRegression> trainMultiFeatureModel() {
+        auto model = std::make_shared<LinearRegression>();
+        auto loss = std::make_shared<MSE>();
+        auto optimizer = std::make_shared<GradientDescent>(loss, 0.05, 2000);
+
+        // y = 3*x1 + 2*x2 + 1
+        Eigen::MatrixXd X(5,2);
+        X << 1,2,
+             2,1,
+             3,0,
+             0,3,
+             4,2;
+        Eigen::VectorXd y(5);
+        y << 8,9,10,7,17;
+
+        model->train(X, y, optimizer);
+        return model;
+    }
+}
+
+TEST(SiML, BatchingPredictorThrowsOnNullModel) {
+    EXPECT_THROW(BatchingPredictor(nullptr, 8, std::chrono::microseconds(100)),
+                 std::invalid_argument);
+}
+
+TEST(SiML, BatchingPredictorThrowsOnUntrainedModel) {
+    auto model = std::make_shared<LinearRegression>();
+
+    EXPECT_THROW(BatchingPredictor(model, 8, std::chrono::microseconds(100)),
+                 std::invalid_argument);
+}
+
+TEST(SiML, BatchingPredictorThrowsOnZeroBatchSize) {
+    auto model = trainMultiFeatureModel();
+
+    EXPECT_THROW(BatchingPredictor(model, 0, std::chrono::microseconds(100)),
+                 std::invalid_argument);
+}
+
+TEST(SiML, BatchingPredictorThrowsOnFeatureMismatch) {
+    auto model = trainMultiFeatureModel();
+    BatchingPredictor predictor(model, 8, std::chrono::microseconds(100));
+
+    Eigen::VectorXd x(3); // wrong number of features
+    x << 1,2,3;
+
+    EXPECT_THROW(predictor.predict(x), std::invalid_argument);
+}
+
+TEST(SiML, BatchingPredictorSingleRequestFlushesOnDeadline) {
+    auto model = trainMultiFeatureModel();
+    // Batch size is never reached, so only the deadline can complete the request
+    BatchingPredictor predictor(model, 1000, std::chrono::microseconds(500));
+
+    Eigen::VectorXd x(2);
+    x << 2,7;
+
+    std::future<double> result = predictor.predict(x);
+
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_DOUBLE_EQ(result.get(), model->predict(x.transpose())[0]);
+}
+
+TEST(SiML, BatchingPredictorMatchesDirectPredictionsAcrossThreads) {
+    auto model = trainMultiFeatureModel();
+    BatchingPredictor predictor(model, 16, std::chrono::microseconds(200));
+
+    const int n_threads = 8;
+    const int n_requests = 200;
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(n_threads * n_requests, 2);
+    Eigen::VectorXd expected = model->predict(X);
+    Eigen::VectorXd actual(X.rows());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&, t] {
+            std::vector<std::future<double>> results;
+            for (int i = 0; i < n_requests; ++i) {
+                results.push_back(predictor.predict(X.row(t * n_requests + i).transpose()));
+            }
+            for (int i = 0; i < n_requests; ++i) {
+                actual[t * n_requests + i] = results[i].get();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < X.rows(); ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 1e-12);
+    }
+}
+
+TEST(SiML, BatchingPredictorCompletesPendingRequestsOnDestruction) {
+    auto model = trainMultiFeatureModel();
+
+    Eigen::VectorXd x(2);
+    x << 1,1;
+
+    std::future<double> result;
+    {
+        BatchingPredictor predictor(model, 1000, std::chrono::seconds(60));
+        result = predictor.predict(x);
+    }
+
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_DOUBLE_EQ(result.get(), model->predict(x.transpose())[0]);
+}
+
+TEST(SiML, BatchingPredictorFlushesFullBatchesBeforeDeadline) {
+    auto model = trainMultiFeatureModel();
+    // The deadline is far away, so only the size trigger can complete requests
+    BatchingPredictor predictor(model, 4, std::chrono::seconds(60));
+
+    Eigen::VectorXd x(2);
+    x << 3,4;
+
+    std::vector<std::future<double>> results;
+    for (int i = 0; i < 8; ++i) {
+        results.push_back(predictor.predict(x));
+    }
+
+    for (auto &result : results) {
+        ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        EXPECT_DOUBLE_EQ(result.get(), model->predict(x.transpose())[0]);
+    }
+    EXPECT_EQ(predictor.batch_count(), 2u);
+}
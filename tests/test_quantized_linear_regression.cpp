@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "quantized_model.hpp"
+
+using namespace SiML;
+
+namespace {
+    LinearRegression trainMultiFeatureModel() {
+        LinearRegression model;
+        auto loss = std::make_shared<MSE>();
+        auto optimizer = std::make_shared<GradientDescent>(loss, 0.05, 2000);
+
+        // y = 3*x1 + 2*x2 + 1
+        Eigen::MatrixXd X(5,2);
+        X << 1,2,
+             2,1,
+             3,0,
+             0,3,
+             4,2;
+        Eigen::VectorXd y(5);
+        y << 8,9,10,7,17;
+
+        model.train(X, y, optimizer);
+        return model;
+    }
+}
+
+TEST(SiML, QuantizedLinearRegressionThrowsOnUntrainedModel) {
+    LinearRegression model;
+
+    EXPECT_THROW(QuantizedLinearRegression quantized(model), std::invalid_argument);
+}
+
+TEST(SiML, QuantizedLinearRegressionThrowsOnPredictMismatch) {
+    LinearRegression model = trainMultiFeatureModel();
+    QuantizedLinearRegression quantized(model);
+
+    Eigen::MatrixXd X_bad(2,3); // wrong number of features
+    X_bad << 1,2,3,4,5,6;
+
+    EXPECT_THROW(quantized.predict(X_bad), std::invalid_argument);
+}
+
+TEST(SiML, QuantizedLinearRegressionMatchesDoubleModel) {
+    LinearRegression model = trainMultiFeatureModel();
+    QuantizedLinearRegression quantized(model);
+
+    EXPECT_FALSE(quantized.quantizes_inputs());
+    EXPECT_EQ(quantized.weights().size(), model.weights().size());
+
+    // Each weight is recovered to within half a quantization step
+    for (int j = 0; j < model.weights().size(); ++j) {
+        double dequantized = quantized.scale() * (quantized.weights()[j] - quantized.zero_point());
+        EXPECT_NEAR(dequantized, model.weights()[j], 0.5 * quantized.scale() + 1e-12);
+    }
+
+    Eigen::MatrixXd X(3,2);
+    X << 1,1,
+         5,0,
+         2,7;
+
+    QuantizationError error = quantized.quantization_error(model, X);
+    EXPECT_LT(error.max_abs_error, 0.1);
+    EXPECT_LE(error.mean_abs_error, error.max_abs_error);
+    EXPECT_LE(error.rmse, error.max_abs_error);
+}
+
+TEST(SiML, QuantizedLinearRegressionQuantizedInputs) {
+    LinearRegression model = trainMultiFeatureModel();
+    QuantizedLinearRegression quantized(model, true);
+
+    EXPECT_TRUE(quantized.quantizes_inputs());
+
+    Eigen::MatrixXd X(3,2);
+    X << 1,1,
+         5,0,
+         2,7;
+
+    Eigen::VectorXd y_ref = model.predict(X);
+    Eigen::VectorXd y_pred = quantized.predict(X);
+
+    for (int i = 0; i < y_ref.size(); ++i) {
+        EXPECT_NEAR(y_pred[i], y_ref[i], 0.2);
+    }
+
+    // A zero row only leaves the bias
+    Eigen::MatrixXd zeros = Eigen::MatrixXd::Zero(1,2);
+    EXPECT_DOUBLE_EQ(quantized.predict(zeros)[0], model.bias());
+}
+
+TEST(SiML, QuantizedLinearRegressionThrowsOnEmptyErrorSet) {
+    LinearRegression model = trainMultiFeatureModel();
+    QuantizedLinearRegression quantized(model);
+
+    Eigen::MatrixXd X(0,2);
+
+    EXPECT_THROW(quantized.quantization_error(model, X), std::invalid_argument);
+}
+
+TEST(SiML, QuantizedLinearRegressionSharedFeaturesMatchPerCallQuantization) {
+    // Enough features and samples to cover the unrolled and tiled kernels
+    Eigen::MatrixXd X_train = Eigen::MatrixXd::Random(50, 9);
+    Eigen::VectorXd y_train = Eigen::VectorXd::Random(50);
+    LinearRegression model;
+    model.train(X_train, y_train, std::make_shared<GradientDescent>(std::make_shared<MSE>(), 0.05, 200));
+
+    QuantizedLinearRegression quantized(model);
+    QuantizedLinearRegression quantized_inputs(model, true);
+
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(700, 9);
+    QuantizedFeatures X_q = QuantizedLinearRegression::quantize_features(X);
+
+    EXPECT_EQ(X_q.values.rows(), 700);
+    EXPECT_EQ(X_q.values.cols(), 9);
+
+    Eigen::VectorXd y_ref = model.predict(X);
+    Eigen::VectorXd y_weights = quantized.predict(X);
+    Eigen::VectorXd y_shared = quantized.predict(X_q);
+    Eigen::VectorXd y_inputs = quantized_inputs.predict(X);
+
+    for (int i = 0; i < X.rows(); ++i) {
+        EXPECT_NEAR(y_weights[i], y_ref[i], 0.05);
+        EXPECT_NEAR(y_shared[i], y_ref[i], 0.05);
+        EXPECT_DOUBLE_EQ(y_shared[i], y_inputs[i]);
+    }
+
+    // The single-sample path agrees with the batched one
+    QuantizedFeatures row_q = QuantizedLinearRegression::quantize_features(X.topRows(1));
+    EXPECT_DOUBLE_EQ(quantized.predict(row_q)[0], y_shared[0]);
+
+    Eigen::MatrixXd X_bad = Eigen::MatrixXd::Random(2, 4);
+    EXPECT_THROW(quantized.predict(QuantizedLinearRegression::quantize_features(X_bad)), std::invalid_argument);
+}
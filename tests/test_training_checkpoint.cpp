@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+#include "model.hpp"
+#include "optimizer.hpp"
+#include "loss_function.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace SiML;
+
+namespace {
+    // Dataset: y = 3*x1 + 2*x2 + 1
+    void makeData(Eigen::MatrixXd &X, Eigen::VectorXd &y) {
+        X.resize(5, 2);
+        X << 1,2,
+             2,1,
+             3,0,
+             0,3,
+             4,2;
+        y.resize(5);
+        y << 8,9,10,7,17;
+    }
+
+    std::filesystem::path checkpointPath(const std::string &name) {
+        std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove(path);
+        return path;
+    }
+
+    // MSE that aborts the run after a number of epochs, simulating a preemption
+    class PreemptedMSE : public MSE {
+        public:
+            explicit PreemptedMSE(int epochs) : m_remaining(epochs) {}
+
+            Eigen::VectorXd gradient(const Eigen::VectorXd &y_true,
+                                     const Eigen::VectorXd &y_pred) const override {
+                if (m_remaining-- == 0) {
+                    throw std::runtime_error("preempted");
+                }
+                return MSE::gradient(y_true, y_pred);
+            }
+
+        private:
+            mutable int m_remaining;
+    };
+
+    // Run @p config for up to 500 epochs but stop after @p epochs; return the
+    // epoch of the checkpoint left behind, or -1 if there is none.
+    long preemptAfter(int epochs, const CheckpointConfig &config) {
+        Eigen::MatrixXd X;
+        Eigen::VectorXd y;
+        makeData(X, y);
+
+        Eigen::VectorXd weights = Eigen::VectorXd::Zero(2);
+        double bias = 0.0;
+        GradientDescent gd(std::make_shared<PreemptedMSE>(epochs), 0.05, 500);
+        gd.set_checkpointing(config);
+        EXPECT_THROW(gd.optimize(X, y, weights, bias), std::runtime_error);
+
+        if (!std::filesystem::exists(config.path)) {
+            return -1;
+        }
+        return static_cast<long>(TrainingCheckpoint::load(config.path).epoch);
+    }
+}
+
+TEST(SiML, TrainingCheckpointSaveLoadRoundTrip) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_roundtrip.bin");
+
+    TrainingCheckpoint checkpoint;
+    checkpoint.n_samples = 11;
+    checkpoint.max_epochs = 100;
+    checkpoint.data_hash = 0x0123456789ABCDEFULL;
+    checkpoint.epoch = 42;
+    checkpoint.learning_rate = 0.05;
+    checkpoint.bias = -1.25;
+    checkpoint.weights = Eigen::VectorXd::Random(7);
+    checkpoint.save(path);
+
+    TrainingCheckpoint loaded = TrainingCheckpoint::load(path);
+    EXPECT_EQ(loaded.n_samples, checkpoint.n_samples);
+    EXPECT_EQ(loaded.max_epochs, checkpoint.max_epochs);
+    EXPECT_EQ(loaded.data_hash, checkpoint.data_hash);
+    EXPECT_EQ(loaded.epoch, checkpoint.epoch);
+    EXPECT_EQ(loaded.learning_rate, checkpoint.learning_rate);
+    EXPECT_EQ(loaded.bias, checkpoint.bias);
+    EXPECT_EQ(loaded.weights, checkpoint.weights);
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, TrainingCheckpointThrowsOnInvalidFile) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_invalid.bin");
+
+    EXPECT_THROW(TrainingCheckpoint::load(path), std::runtime_error);
+
+    std::ofstream(path, std::ios::binary) << "not a checkpoint";
+    EXPECT_THROW(TrainingCheckpoint::load(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, TrainingCheckpointSaveFailureLeavesNoTemporaryFile) {
+    std::filesystem::path dir = checkpointPath("siml_checkpoint_dir");
+    std::filesystem::create_directory(dir);
+
+    // Renaming a file over a non-empty directory fails
+    std::ofstream(dir / "occupied") << "x";
+    TrainingCheckpoint checkpoint;
+    checkpoint.weights = Eigen::VectorXd::Zero(2);
+
+    EXPECT_THROW(checkpoint.save(dir), std::runtime_error);
+    EXPECT_FALSE(std::filesystem::exists(dir.string() + ".tmp"));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(SiML, TrainingCheckpointHashDependsOnData) {
+    Eigen::MatrixXd X;
+    Eigen::VectorXd y;
+    makeData(X, y);
+
+    EXPECT_EQ(TrainingCheckpoint::hash_data(X, y), TrainingCheckpoint::hash_data(X, y));
+    EXPECT_NE(TrainingCheckpoint::hash_data(X, y), TrainingCheckpoint::hash_data(X, -y));
+    EXPECT_NE(TrainingCheckpoint::hash_data(X, y), TrainingCheckpoint::hash_data(X * 2.0, y));
+}
+
+TEST(SiML, GradientDescentResumesBitIdentically) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_resume.bin");
+    Eigen::MatrixXd X;
+    Eigen::VectorXd y;
+    makeData(X, y);
+    auto loss = std::make_shared<MSE>();
+
+    // Uninterrupted reference run
+    Eigen::VectorXd weights_ref = Eigen::VectorXd::Zero(2);
+    double bias_ref = 0.0;
+    GradientDescent(loss, 0.05, 500).optimize(X, y, weights_ref, bias_ref);
+
+    // Run that is preempted after 230 epochs, leaving the epoch-200 checkpoint
+    CheckpointConfig config;
+    config.path = path;
+    config.every_epochs = 100;
+    config.resume = true;
+    EXPECT_EQ(preemptAfter(230, config), 200);
+
+    // The restarted job resumes from it
+    Eigen::VectorXd weights_resumed = Eigen::VectorXd::Zero(2);
+    double bias_resumed = 0.0;
+    GradientDescent resumed(loss, 0.05, 500);
+    resumed.set_checkpointing(config);
+    resumed.optimize(X, y, weights_resumed, bias_resumed);
+
+    EXPECT_EQ(weights_resumed, weights_ref);
+    EXPECT_EQ(bias_resumed, bias_ref);
+    EXPECT_EQ(TrainingCheckpoint::load(path).epoch, 500u);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, GradientDescentTimeBasedCheckpoints) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_time.bin");
+
+    CheckpointConfig config;
+    config.path = path;
+
+    // An interval shorter than an epoch saves after every epoch
+    config.every_seconds = std::chrono::nanoseconds(1);
+    EXPECT_EQ(preemptAfter(37, config), 37);
+
+    // An interval longer than the run never fires before the preemption
+    std::filesystem::remove(path);
+    config.every_seconds = std::chrono::hours(1);
+    EXPECT_EQ(preemptAfter(37, config), -1);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, GradientDescentWithoutIntervalsSavesOnCompletionOnly) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_completion.bin");
+    Eigen::MatrixXd X;
+    Eigen::VectorXd y;
+    makeData(X, y);
+
+    CheckpointConfig config;
+    config.path = path;
+
+    EXPECT_EQ(preemptAfter(37, config), -1);
+
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero(2);
+    double bias = 0.0;
+    GradientDescent gd(std::make_shared<MSE>(), 0.05, 50);
+    gd.set_checkpointing(config);
+    gd.optimize(X, y, weights, bias);
+
+    TrainingCheckpoint checkpoint = TrainingCheckpoint::load(path);
+    EXPECT_EQ(checkpoint.epoch, 50u);
+    EXPECT_EQ(checkpoint.weights, weights);
+    EXPECT_EQ(checkpoint.bias, bias);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, GradientDescentSequentialTrainingWithSharedCheckpointingOptimizer) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_sequential.bin");
+    Eigen::MatrixXd X;
+    Eigen::VectorXd y;
+    makeData(X, y);
+
+    CheckpointConfig config;
+    config.path = path;
+    config.every_epochs = 100;
+
+    auto gd = std::make_shared<GradientDescent>(std::make_shared<MSE>(), 0.05, 2000);
+    gd->set_checkpointing(config);
+
+    // Without resume, the second run trains from scratch on its own data
+    LinearRegression a, b;
+    a.train(X, y, gd);
+    b.train(X, -y, gd);
+
+    EXPECT_NEAR(a.weights()[0], 3.0, 1e-2);
+    EXPECT_NEAR(b.weights()[0], -3.0, 1e-2);
+    EXPECT_NEAR(b.bias(), -1.0, 1e-2);
+
+    // With resume, the finished checkpoint of b is rejected for a's data
+    config.resume = true;
+    gd->set_checkpointing(config);
+    LinearRegression c;
+    EXPECT_THROW(c.train(X, y, gd), std::invalid_argument);
+
+    std::filesystem::remove(path);
+}
+
+TEST(SiML, GradientDescentThrowsOnMismatchedCheckpoint) {
+    std::filesystem::path path = checkpointPath("siml_checkpoint_mismatch.bin");
+    Eigen::MatrixXd X;
+    Eigen::VectorXd y;
+    makeData(X, y);
+    auto loss = std::make_shared<MSE>();
+
+    CheckpointConfig config;
+    config.path = path;
+    config.every_epochs = 10;
+    config.resume = true;
+
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero(2);
+    double bias = 0.0;
+    GradientDescent gd(loss, 0.05, 20);
+    gd.set_checkpointing(config);
+    gd.optimize(X, y, weights, bias);
+
+    // Different learning rate
+    GradientDescent other_rate(loss, 0.01, 20);
+    other_rate.set_checkpointing(config);
+    EXPECT_THROW(other_rate.optimize(X, y, weights, bias), std::invalid_argument);
+
+    // Different number of epochs
+    GradientDescent other_epochs(loss, 0.05, 40);
+    other_epochs.set_checkpointing(config);
+    EXPECT_THROW(other_epochs.optimize(X, y, weights, bias), std::invalid_argument);
+
+    // Different number of features
+    Eigen::MatrixXd X_bad = Eigen::MatrixXd::Ones(5, 3);
+    Eigen::VectorXd weights_bad = Eigen::VectorXd::Zero(3);
+    EXPECT_THROW(gd.optimize(X_bad, y, weights_bad, bias), std::invalid_argument);
+
+    std::filesystem::remove(path);
+}